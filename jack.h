@@ -337,6 +337,15 @@ void jack_on_info_shutdown (jack_client_t *client,
  * malloc, free, printf, pthread_mutex_lock, sleep, wait, poll, select, pthread_join,
  * pthread_cond_wait, etc, etc. 
  *
+ * The server may run the @a process_callback of clients that do not
+ * depend on each other's output concurrently, on different CPU cores.
+ * A client is only ever called after all clients feeding its input
+ * ports have finished the current cycle, and before any client fed by
+ * its output ports starts it.  This does not apply to connections
+ * that close a feedback loop in the graph: the data on such a
+ * connection is the output of the previous cycle, so it arrives one
+ * cycle late.
+ *
  * @return 0 on success, otherwise a non-zero error code, causing JACK
  * to remove that client from the process() graph.
  */
@@ -426,6 +435,7 @@ int jack_set_port_connect_callback (jack_client_t *,
 /**
  * Tell the JACK server to call @a graph_callback whenever the
  * processing graph is reordered, passing @a arg as a parameter.
+ * This includes changes to which clients may run concurrently.
  *
  * @return 0 on success, otherwise a non-zero error code
  */
@@ -613,7 +623,10 @@ float jack_cpu_load (jack_client_t *client) JACK_OPTIONAL_WEAK_EXPORT;
  *
  * All ports have a type, which may be any non-NULL and non-zero
  * length string, passed as an argument.  Some port types are built
- * into the JACK API, like JACK_DEFAULT_AUDIO_TYPE or JACK_DEFAULT_MIDI_TYPE
+ * into the JACK API, like JACK_DEFAULT_AUDIO_TYPE, JACK_DOUBLE_AUDIO_TYPE
+ * or JACK_DEFAULT_MIDI_TYPE.  Registering a port of type
+ * JACK_MULTICHANNEL_AUDIO_TYPE with this function is the same as calling
+ * jack_port_register_multichannel() with one channel.
  *
  * @param client pointer to JACK client structure.
  * @param port_name non-empty short name for the new port (not
@@ -624,6 +637,10 @@ float jack_cpu_load (jack_client_t *client) JACK_OPTIONAL_WEAK_EXPORT;
  * @param buffer_size must be non-zero if this is not a built-in @a
  * port_type.  Otherwise, it is ignored.
  *
+ * Registering a port does not reserve shared memory for its buffer.
+ * That happens when the port is first connected, so spare ports that
+ * are never connected cost very little.
+ *
  * @return jack_port_t pointer on success, otherwise NULL.
  */
 jack_port_t *jack_port_register (jack_client_t *client,
@@ -632,6 +649,27 @@ jack_port_t *jack_port_register (jack_client_t *client,
                                  unsigned long flags,
                                  unsigned long buffer_size) JACK_OPTIONAL_WEAK_EXPORT;
 
+/**
+ * Create a new port carrying @a channels channels of audio in a
+ * single buffer.  This behaves like jack_port_register(), but a
+ * single port, connection and buffer lookup replaces one per channel,
+ * which keeps the graph small for wide streams.
+ *
+ * @param client pointer to JACK client structure.
+ * @param port_name non-empty short name for the new port (not
+ * including the leading @a "client_name:"). Must be unique.
+ * @param flags @ref JackPortFlags bit mask.
+ * @param channels number of channels, at least 1.
+ *
+ * The new port has type JACK_MULTICHANNEL_AUDIO_TYPE.
+ *
+ * @return jack_port_t pointer on success, otherwise NULL.
+ */
+jack_port_t *jack_port_register_multichannel (jack_client_t *client,
+                                              const char *port_name,
+                                              unsigned long flags,
+                                              unsigned int channels) JACK_WEAK_EXPORT;
+
 /** 
  * Remove the port from the client, disconnecting any existing
  * connections.
@@ -648,11 +686,98 @@ int jack_port_unregister (jack_client_t *, jack_port_t *) JACK_OPTIONAL_WEAK_EXP
  * zero-filled. if there are multiple inbound connections, the data
  * will be mixed appropriately.  
  *
+ * All unconnected input ports share a single read-only, zero-filled
+ * buffer.  Until an output port is first connected, its buffer is
+ * private memory of the client rather than shared memory.
+ *
+ * If an input port has exactly one connection, the returned address
+ * is the buffer of the connected output port itself and no copy is
+ * made (see jack_port_buffer_is_aliased()).  The exception is when
+ * that output port was marked with jack_port_mark_silent() in the
+ * current cycle: its buffer may not have been written, so the shared
+ * zero-filled buffer is returned instead.  Clients must therefore
+ * never write to the buffer of an input port, except through an
+ * output port paired with it by jack_port_set_in_place().
+ *
+ * The returned address is aligned to at least the number of bytes
+ * given by jack_port_type_get_buffer_alignment() for the port's type,
+ * and the buffer is padded so that its length is a multiple of that
+ * alignment.  Clients may use aligned vector loads and stores on the
+ * whole buffer without checking the address each cycle.
+ *
  * Do not cache the returned address across process() callbacks.
  * Port buffers have to be retrieved in each callback for proper functionning.
  */
 void *jack_port_get_buffer (jack_port_t *, jack_nframes_t) JACK_OPTIONAL_WEAK_EXPORT;
 
+/**
+ * Retrieve the buffers of several ports at once.  This is equivalent
+ * to calling jack_port_get_buffer() on each of the @a nports entries
+ * of @a ports and storing the results in the same positions of
+ * @a buffers, but resolves all of them in a single call.  Clients
+ * with many ports should prefer it in their process() callback.
+ *
+ * The same rules as for jack_port_get_buffer() apply to each returned
+ * address.  In particular they must not be cached across process()
+ * callbacks.
+ *
+ * @param ports array of @a nports port handles.
+ * @param nports number of entries in @a ports and @a buffers.
+ * @param nframes number of frames to process, as passed to the
+ * process() callback.
+ * @param buffers array of at least @a nports entries to fill in.
+ *
+ * @return 0 on success, otherwise a non-zero error code.  On failure
+ * the contents of @a buffers are undefined.
+ */
+int jack_port_get_buffers (jack_port_t **ports,
+                           unsigned int nports,
+                           jack_nframes_t nframes,
+                           void **buffers) JACK_WEAK_EXPORT;
+
+/**
+ * @return TRUE if the buffer of @a port holds only silence for the
+ * current process cycle, FALSE otherwise.
+ *
+ * For an input port this is the case when it has no connections, or
+ * when every port connected to it was marked silent with
+ * jack_port_mark_silent() during this cycle.  Clients may then skip
+ * any processing of the buffer; its contents are still zero-filled.
+ *
+ * A FALSE return does not imply the buffer holds non-zero data.
+ *
+ * This function may only be called from the process() callback.
+ */
+int jack_port_is_silent (jack_port_t *port) JACK_WEAK_EXPORT;
+
+/**
+ * Mark the buffer of the locally-owned output @a port as silent for
+ * the current process cycle.  The client need not write to the
+ * buffer: JACK ensures that connected input ports see a zero-filled
+ * buffer and report TRUE from jack_port_is_silent(), and skips the
+ * port when mixing inputs with several connections.
+ *
+ * The mark applies to the current cycle only.  The client must not
+ * write to the buffer after making this call.
+ *
+ * This function may only be called from the process() callback.
+ *
+ * @return 0 on success, otherwise a non-zero error code.
+ */
+int jack_port_mark_silent (jack_port_t *port) JACK_WEAK_EXPORT;
+
+/**
+ * @return TRUE if the buffer returned by jack_port_get_buffer() for
+ * the input @a port in the current process cycle is the buffer of the
+ * single output port connected to it, FALSE if it is a separate copy
+ * or mixdown.  It also returns FALSE if the connected output port was
+ * marked with jack_port_mark_silent() in the current cycle, since the
+ * shared zero-filled buffer is returned in that case.
+ *
+ * This function may only be called from the process() callback.
+ */
+int jack_port_buffer_is_aliased (jack_port_t *port) JACK_WEAK_EXPORT;
+
 /**
  * @return the full name of the jack_port_t (including the @a
  * "client_name:" prefix).
@@ -743,6 +868,37 @@ const char **jack_port_get_connections (const jack_port_t *port) JACK_OPTIONAL_W
 const char **jack_port_get_all_connections (const jack_client_t *client,
 					    const jack_port_t *port) JACK_OPTIONAL_WEAK_EXPORT;
 
+/**
+ * Perform the same function as jack_port_get_connections(), but store
+ * the ids of the connected ports in the caller-supplied array @a ids
+ * instead of returning newly allocated names.  This function does
+ * not allocate memory.  Use jack_port_by_id() to obtain the ports.
+ *
+ * @param port locally owned jack_port_t pointer.
+ * @param ids array of at least @a max_ids entries to fill in.
+ * @param max_ids number of entries available in @a ids.
+ *
+ * @return the number of connections, which may exceed @a max_ids
+ * (only the first @a max_ids are stored), or -1 on error.
+ */
+int jack_port_get_connection_ids (const jack_port_t *port,
+                                  jack_port_id_t *ids,
+                                  unsigned int max_ids) JACK_WEAK_EXPORT;
+
+/**
+ * Perform the same function as jack_port_get_all_connections(), but
+ * store the ids of the connected ports in the caller-supplied array
+ * @a ids.  The same restrictions as for jack_port_get_all_connections()
+ * apply.  This function does not allocate memory.
+ *
+ * @return the number of connections, which may exceed @a max_ids
+ * (only the first @a max_ids are stored), or -1 on error.
+ */
+int jack_port_get_all_connection_ids (const jack_client_t *client,
+                                      const jack_port_t *port,
+                                      jack_port_id_t *ids,
+                                      unsigned int max_ids) JACK_WEAK_EXPORT;
+
 /**
  *
  * @deprecated This function will be removed from a future version 
@@ -761,6 +917,57 @@ int  jack_port_tie (jack_port_t *src, jack_port_t *dst) JACK_OPTIONAL_WEAK_DEPRE
  */
 int  jack_port_untie (jack_port_t *port) JACK_OPTIONAL_WEAK_DEPRECATED_EXPORT;
 
+/**
+ * Declare that the client processes the locally-owned input port
+ * @a src in place into the locally-owned output port @a dst, as
+ * a gain stage or other sample-by-sample effect would.  Both ports
+ * must have the same type.
+ *
+ * JACK gives both ports the same storage in a process cycle only if
+ * all of the following hold:
+ *
+ *    - @a src is connected to exactly one output port,
+ *    - @a src is the only port connected to that output port,
+ *    - that output port was not marked with jack_port_mark_silent()
+ *      in the current cycle, and
+ *    - the connection into @a src does not close a feedback loop,
+ *      i.e. the client owning that output port cannot read the data
+ *      written to @a dst, directly or through other clients.
+ *
+ * Apart from @a src and @a dst, only the output port feeding @a src
+ * then uses the storage, and its owner has finished with it before
+ * this client runs, so it is safe to overwrite: jack_port_get_buffer()
+ * returns the same address for
+ * @a src and @a dst, already holding the input data, and the client
+ * writes its output over it.  In every other case, including when
+ * @a src is unconnected and returns the shared zero-filled buffer,
+ * the ports keep separate buffers as usual.  Clients must handle both
+ * cases, for example by comparing the two addresses or calling
+ * jack_port_is_in_place().
+ *
+ * Unlike jack_port_tie(), the client still runs its process()
+ * callback and is responsible for the data written to @a dst.
+ *
+ * @return 0 on success, otherwise a non-zero error code.
+ */
+int jack_port_set_in_place (jack_port_t *src, jack_port_t *dst) JACK_WEAK_EXPORT;
+
+/**
+ * Remove any in-place pairing set up for @a port with
+ * jack_port_set_in_place().  @a port may be either port of the pair.
+ *
+ * @return 0 on success, otherwise a non-zero error code.
+ */
+int jack_port_unset_in_place (jack_port_t *port) JACK_WEAK_EXPORT;
+
+/**
+ * @return TRUE if @a port shares its buffer with its in-place partner
+ * in the current process cycle, FALSE otherwise.
+ *
+ * This function may only be called from the process() callback.
+ */
+int jack_port_is_in_place (jack_port_t *port) JACK_WEAK_EXPORT;
+
 /**
  * Modify a port's short name.  May be called at any time.  If the
  * resulting full name (including the @a "client_name:" prefix) is
@@ -853,6 +1060,9 @@ int jack_port_monitoring_input (jack_port_t *port) JACK_OPTIONAL_WEAK_EXPORT;
  *
  * @pre The port types must be identical.
  *
+ * @pre The ports must carry the same number of channels (see
+ * jack_port_channel_count()).
+ *
  * @pre The @ref JackPortFlags of the @a source_port must include @ref
  * JackPortIsOutput.
  *
@@ -910,13 +1120,49 @@ int jack_port_name_size(void) JACK_OPTIONAL_WEAK_EXPORT;
  */
 int jack_port_type_size(void) JACK_OPTIONAL_WEAK_EXPORT;
 
+/**
+ * @return the number of channels carried by @a port.  This is the
+ * value given to jack_port_register_multichannel(), or 1 for ports
+ * registered with jack_port_register().
+ */
+unsigned int jack_port_channel_count (const jack_port_t *port) JACK_WEAK_EXPORT;
+
+/**
+ * @return the distance, in samples, between the starts of consecutive
+ * channels in the buffer of @a port.  This is the current buffer size
+ * rounded up so that every channel starts on the alignment given by
+ * jack_port_type_get_buffer_alignment().  It only changes when the
+ * buffer size changes, so clients may cache it in a @a bufsize_callback.
+ */
+jack_nframes_t jack_port_channel_stride (const jack_port_t *port) JACK_WEAK_EXPORT;
+
 /**
  * @return the buffersize of a port of type @arg port_type.
+ * For JACK_DOUBLE_AUDIO_TYPE this is nframes *
+ * sizeof(jack_double_audio_sample_t), rounded up to a multiple of
+ * jack_port_type_get_buffer_alignment() for that type.  Because of
+ * this padding it is not in general twice the size reported for
+ * JACK_DEFAULT_AUDIO_TYPE.
+ * For JACK_MULTICHANNEL_AUDIO_TYPE it is the size of a single padded
+ * channel, i.e. jack_port_channel_stride() samples, to be multiplied by
+ * jack_port_channel_count().
  *
  * this function may only be called in a buffer_size callback.
  */
 size_t jack_port_type_get_buffer_size (jack_client_t *client, const char *port_type) JACK_WEAK_EXPORT;
 
+/**
+ * @return the alignment in bytes of buffers returned by
+ * jack_port_get_buffer() for ports of type @arg port_type.  This is
+ * always a power of two, and is at least 64 for JACK_DEFAULT_AUDIO_TYPE
+ * and JACK_DOUBLE_AUDIO_TYPE.
+ * Returns zero if @arg port_type is unknown.
+ *
+ * Unlike the buffer size, the alignment never changes while the
+ * server is running.
+ */
+size_t jack_port_type_get_buffer_alignment (jack_client_t *client, const char *port_type) JACK_WEAK_EXPORT;
+
 /*@}*/
 
 /**
@@ -1160,7 +1406,66 @@ const char **jack_get_ports (jack_client_t *,
 			     unsigned long flags) JACK_OPTIONAL_WEAK_EXPORT;
 
 /**
- * @return address of the jack_port_t named @a port_name.
+ * Compile a port selection for use with jack_get_ports_matching().
+ * The arguments have the same meaning as for jack_get_ports().  The
+ * regular expressions are parsed once here rather than on every
+ * lookup, and a @a port_name_pattern that starts with a literal
+ * prefix (such as "system:") only examines ports with that prefix.
+ *
+ * A compiled pattern is not tied to a client, and may be used with
+ * any number of clients and from any thread.
+ *
+ * @return a new pattern, or NULL if either regular expression is
+ * invalid.  It must be released with jack_port_pattern_free().
+ */
+jack_port_pattern_t *jack_port_pattern_compile (const char *port_name_pattern,
+                                                const char *type_name_pattern,
+                                                unsigned long flags) JACK_WEAK_EXPORT;
+
+/**
+ * Release a pattern returned by jack_port_pattern_compile().
+ */
+void jack_port_pattern_free (jack_port_pattern_t *pattern) JACK_WEAK_EXPORT;
+
+/**
+ * Perform the same function as jack_get_ports() using a compiled
+ * @a pattern.
+ *
+ * @param pattern a compiled pattern, or NULL to select all ports.
+ *
+ * @return a NULL-terminated array of ports that match @a pattern.
+ * The caller is responsible for calling jack_free(3) any non-NULL
+ * returned value.
+ */
+const char **jack_get_ports_matching (jack_client_t *,
+                                      const jack_port_pattern_t *pattern) JACK_WEAK_EXPORT;
+
+/**
+ * Perform the same function as jack_get_ports_matching(), but store
+ * the ids of the matching ports in the caller-supplied array @a ids
+ * instead of returning newly allocated names.  This function does
+ * not allocate memory.  Use jack_port_by_id() to obtain the ports.
+ *
+ * @param pattern a compiled pattern, or NULL to select all ports.
+ * @param ids array of at least @a max_ids entries to fill in.
+ * @param max_ids number of entries available in @a ids.
+ *
+ * @return the number of matching ports, which may exceed @a max_ids
+ * (only the first @a max_ids are stored), or -1 on error.
+ */
+int jack_get_port_ids (jack_client_t *,
+                       const jack_port_pattern_t *pattern,
+                       jack_port_id_t *ids,
+                       unsigned int max_ids) JACK_WEAK_EXPORT;
+
+/**
+ * @return address of the jack_port_t named @a port_name, or NULL if
+ * there is no such port.  @a port_name may be either the full name of
+ * the port or one of its aliases (see jack_port_set_alias()).
+ *
+ * Ports are looked up in a hashed table of names and aliases that is
+ * kept up to date as ports are registered, renamed and aliased, so
+ * the cost of this function does not grow with the number of ports.
  *
  * @see jack_port_name_size()
  */
@@ -1263,6 +1568,26 @@ int jack_get_cycle_times (const jack_client_t *client,
                           jack_time_t    *next_usecs,
 		          float          *period_usecs) JACK_OPTIONAL_WEAK_EXPORT;
 
+/**
+ * @return the time, in microseconds on the jack_get_time() clock, by
+ * which the current process cycle must be completed to avoid an xrun.
+ *
+ * This function may only be used from the process callback.
+ */
+jack_time_t jack_cycle_deadline (const jack_client_t *client) JACK_WEAK_EXPORT;
+
+/**
+ * @return the estimated number of microseconds left before
+ * jack_cycle_deadline(), or zero if the deadline has already passed.
+ *
+ * This function may only be used from the process callback, and is
+ * suitable for real-time execution.  Clients that can trade quality
+ * for speed may use it to decide how much work to do in the rest of
+ * the cycle.  Note that clients running later in the graph share the
+ * same remaining time.
+ */
+jack_time_t jack_cycle_remaining_usecs (const jack_client_t *client) JACK_WEAK_EXPORT;
+
 /**
  * @return the estimated time in microseconds of the specified frame time
  */
@@ -1273,6 +1598,86 @@ jack_time_t jack_frames_to_time(const jack_client_t *client, jack_nframes_t) JAC
  */
 jack_nframes_t jack_time_to_frames(const jack_client_t *client, jack_time_t) JACK_OPTIONAL_WEAK_EXPORT;
 
+/**
+ * Take a snapshot of the timing state used by jack_frames_to_time()
+ * and jack_time_to_frames().  Unlike jack_get_cycle_times(), this may
+ * be called from any thread; the values stored in @a snapshot always
+ * belong to the same cycle.
+ *
+ * @return zero if OK, non-zero otherwise.
+ */
+int jack_get_clock_snapshot (const jack_client_t *client,
+                             jack_clock_snapshot_t *snapshot) JACK_WEAK_EXPORT;
+
+/**
+ * Convert @a n frame times to microseconds using @a snapshot, as
+ * jack_frames_to_time() would have done in the cycle the snapshot was
+ * taken.  This function is inline and only reads @a snapshot, so
+ * converting many values costs no library calls and no access to the
+ * server's timing state.  Results that fall exactly halfway between
+ * two microseconds may be rounded differently from
+ * jack_frames_to_time().
+ *
+ * This function is suitable for real-time execution.
+ *
+ * @param snapshot timing state filled in by a successful call to
+ * jack_get_clock_snapshot().
+ * @param frames array of @a n frame times to convert.
+ * @param usecs array of at least @a n entries to store the results in.
+ * @param n number of values to convert.
+ */
+static __inline__
+void
+jack_clock_snapshot_frames_to_time (const jack_clock_snapshot_t *snapshot,
+                                    const jack_nframes_t *frames,
+                                    jack_time_t *usecs,
+                                    unsigned int n)
+{
+	const double usecs_per_frame =
+		(double) (int64_t) (snapshot->next_usecs - snapshot->current_usecs)
+		/ (double) snapshot->period_frames;
+	unsigned int i;
+
+	for (i = 0; i < n; i++) {
+		double d = (double) (int32_t) (frames[i] - snapshot->frames) * usecs_per_frame;
+		int64_t dusecs = (int64_t) (d < 0 ? d - 0.5 : d + 0.5);
+		usecs[i] = snapshot->current_usecs + (jack_time_t) dusecs;
+	}
+}
+
+/**
+ * Convert @a n microsecond times to frames using @a snapshot, as
+ * jack_time_to_frames() would have done in the cycle the snapshot was
+ * taken.  Like jack_clock_snapshot_frames_to_time(), this function is
+ * inline and only reads @a snapshot.
+ *
+ * This function is suitable for real-time execution.
+ *
+ * @param snapshot timing state filled in by a successful call to
+ * jack_get_clock_snapshot().
+ * @param usecs array of @a n microsecond times to convert.
+ * @param frames array of at least @a n entries to store the results in.
+ * @param n number of values to convert.
+ */
+static __inline__
+void
+jack_clock_snapshot_time_to_frames (const jack_clock_snapshot_t *snapshot,
+                                    const jack_time_t *usecs,
+                                    jack_nframes_t *frames,
+                                    unsigned int n)
+{
+	const double frames_per_usec =
+		(double) snapshot->period_frames
+		/ (double) (int64_t) (snapshot->next_usecs - snapshot->current_usecs);
+	unsigned int i;
+
+	for (i = 0; i < n; i++) {
+		double d = (double) (int64_t) (usecs[i] - snapshot->current_usecs) * frames_per_usec;
+		int64_t dframes = (int64_t) (d < 0 ? d - 0.5 : d + 0.5);
+		frames[i] = snapshot->frames + (jack_nframes_t) dframes;
+	}
+}
+
 /**
  * @return return JACK's current system time in microseconds,
  *         using the JACK clock source. 
@@ -150,6 +150,30 @@ jack_midi_event_write(void                   *port_buffer,
                       size_t                  data_size) JACK_OPTIONAL_WEAK_EXPORT;
 
 
+/** Copy the entire contents of one event port buffer into another.
+ *
+ * This replaces the contents of @a dst_port_buffer with every event
+ * stored in @a src_port_buffer, using a single copy of the packed
+ * buffer rather than one @ref jack_midi_event_write call per event.
+ * It is intended for thru and routing clients that forward an input
+ * port to an output port unchanged.
+ *
+ * It is not necessary to call @ref jack_midi_clear_buffer on
+ * @a dst_port_buffer first.  Further events may be appended afterwards
+ * with @ref jack_midi_event_reserve or @ref jack_midi_event_write, as
+ * long as their sample offsets are not earlier than the last copied
+ * event.
+ *
+ * @param dst_port_buffer Buffer to copy to (must be an output port buffer).
+ * @param src_port_buffer Buffer to copy from.
+ * @return 0 on success, ENOBUFS if @a dst_port_buffer is too small to hold
+ * the contents of @a src_port_buffer.
+ */
+int
+jack_midi_copy_buffer(void       *dst_port_buffer,
+                      const void *src_port_buffer) JACK_WEAK_EXPORT;
+
+
 /** Get the number of events that could not be written to @a port_buffer.
  *
  * This function returning a non-zero value implies @a port_buffer is full.
@@ -0,0 +1,169 @@
+/*
+    Copyright (C) 2026 JACK developers
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+*/
+
+#ifndef __jack_pool_h__
+#define __jack_pool_h__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <jack/weakmacros.h>
+#include <jack/types.h>
+#include <stdlib.h>
+
+/** @file pool.h
+ *
+ * Library functions that give JACK clients a memory pool they can
+ * allocate from in the process callback.  The pool is divided into
+ * size classes, each holding a fixed number of blocks of one size.
+ * All blocks are allocated and touched when the pool is created or
+ * grown, so allocating and releasing them never calls malloc() or
+ * free().  Where the system permits it the blocks are also locked
+ * into memory, so that using them never causes a page fault; see
+ * jack_pool_create().
+ */
+
+/**
+ * @defgroup MemoryPool Realtime-safe memory allocation
+ * @{
+ */
+
+/**
+ *  jack_pool_t is an opaque type.  You may only access it using the
+ *  API provided.
+ */
+typedef struct _jack_pool jack_pool_t;
+
+/**
+ * Usage statistics of one size class of a pool, as returned by
+ * jack_pool_get_stats().
+ */
+typedef struct {
+    /** size in bytes of the blocks in this class */
+    size_t block_size;
+    /** number of blocks in this class */
+    size_t capacity;
+    /** number of blocks currently allocated */
+    size_t in_use;
+    /** highest value of @a in_use since the pool was created */
+    size_t max_in_use;
+    /** number of allocations that failed because the class was empty */
+    uint32_t failures;
+} jack_pool_stats_t;
+
+/**
+ * Create a memory pool for @a client.  Size class @a i holds
+ * @a block_counts[i] blocks of @a block_sizes[i] bytes.  The pool
+ * memory is locked into RAM if the client's process is allowed to do
+ * so (for example by its RLIMIT_MEMLOCK limit).  If it is not, the
+ * pool is still created, but its pages may be swapped out and a later
+ * access may page fault.
+ *
+ * The pool is released when jack_pool_destroy() is called or, if that
+ * has not happened yet, when the client is closed.  It must not be
+ * used or destroyed after jack_client_close() has been called.
+ *
+ * This function is not suitable for real-time execution.
+ *
+ * @param client the JACK client owning the pool.
+ * @param block_sizes array of @a nclasses block sizes, in bytes, in
+ * increasing order.
+ * @param block_counts array of @a nclasses block counts.
+ * @param nclasses number of size classes.
+ *
+ * @return a pointer to a new jack_pool_t, if successful; NULL
+ * otherwise.
+ */
+jack_pool_t *jack_pool_create (jack_client_t *client,
+                               const size_t *block_sizes,
+                               const size_t *block_counts,
+                               unsigned int nclasses) JACK_WEAK_EXPORT;
+
+/**
+ * Free a pool created by jack_pool_create(), and every block
+ * allocated from it.  Must not be called while any other thread may
+ * still use @a pool, nor after the owning client has been closed.
+ *
+ * This function is not suitable for real-time execution.
+ */
+void jack_pool_destroy (jack_pool_t *pool) JACK_WEAK_EXPORT;
+
+/**
+ * Add @a count blocks to size class @a size_class of @a pool, for
+ * example when a client learns it needs more voices.  The new blocks
+ * are locked into memory under the same conditions as in
+ * jack_pool_create().
+ *
+ * This function is not suitable for real-time execution, but it is
+ * safe to call while other threads, including the process thread,
+ * use jack_pool_alloc() and jack_pool_release() on the same pool.
+ * The new blocks become available to them once it returns.  Calls to
+ * jack_pool_grow() on the same pool must not overlap each other.
+ *
+ * @return 0 on success, otherwise a non-zero error code.
+ */
+int jack_pool_grow (jack_pool_t *pool,
+                    unsigned int size_class,
+                    size_t count) JACK_WEAK_EXPORT;
+
+/**
+ * Allocate a block of at least @a size bytes from the smallest size
+ * class of @a pool that can hold it.  The block is aligned for any
+ * type.
+ *
+ * This function is suitable for real-time execution, and may be
+ * called from any thread.
+ *
+ * @return a pointer to the block, or NULL if the size class is empty
+ * or @a size is larger than the largest class.
+ */
+void *jack_pool_alloc (jack_pool_t *pool, size_t size) JACK_WEAK_EXPORT;
+
+/**
+ * Return a block obtained from jack_pool_alloc() to @a pool.
+ *
+ * This function is suitable for real-time execution, and may be
+ * called from any thread.
+ */
+void jack_pool_release (jack_pool_t *pool, void *ptr) JACK_WEAK_EXPORT;
+
+/**
+ * Retrieve usage statistics for size class @a size_class of @a pool.
+ * The values are read without locking, so while other threads use the
+ * pool they may not all belong to the same instant.
+ *
+ * This function is suitable for real-time execution, and may be
+ * called from any thread, including while other threads use
+ * jack_pool_alloc(), jack_pool_release() or jack_pool_grow() on the
+ * same pool.
+ *
+ * @return 0 on success, otherwise a non-zero error code.
+ */
+int jack_pool_get_stats (jack_pool_t *pool,
+                         unsigned int size_class,
+                         jack_pool_stats_t *stats) JACK_WEAK_EXPORT;
+
+/*@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __jack_pool_h__ */
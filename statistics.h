@@ -25,6 +25,7 @@
 extern "C" {
 #endif
 
+#include <jack/weakmacros.h>
 #include <jack/types.h>
 
 /**
@@ -49,6 +50,112 @@ float jack_get_xrun_delayed_usecs (jack_client_t *client);
  */
 void jack_reset_max_delayed_usecs (jack_client_t *client);
 
+/**
+ * Process callback timing of a single client, as returned by
+ * jack_get_client_load() and jack_get_client_loads().
+ */
+typedef struct {
+    /** average duration of the client's process callback, in usecs */
+    float average_usecs;
+    /** longest duration of the client's process callback since the
+        requesting client opened or last called
+        jack_reset_client_load_max(), in usecs */
+    float max_usecs;
+    /** average share of the cycle period used by the client, in percent */
+    float cycle_share;
+} jack_client_load_t;
+
+/**
+ * Retrieve process callback timing for the client named @a client_name,
+ * averaged over the recent process cycles.  This complements
+ * jack_cpu_load(), which only reports the load of the whole graph, and
+ * makes it possible to identify which client is responsible for it.
+ * Use jack_get_client_loads() to retrieve the load of all clients.
+ *
+ * @param client the client making the request
+ * @param client_name the name of the client to query
+ * @param load place to store the result
+ *
+ * @return 0 on success, otherwise a non-zero error code (for example
+ * if no client named @a client_name exists).
+ */
+int jack_get_client_load (jack_client_t *client,
+                          const char *client_name,
+                          jack_client_load_t *load) JACK_WEAK_EXPORT;
+
+/**
+ * Retrieve process callback timing for every client of the server, as
+ * jack_get_client_load() would return it for each of them, together
+ * with the client names.  This lets an operator find the most
+ * expensive client without knowing its name in advance.  This
+ * function does not allocate memory.
+ *
+ * @param client the client making the request
+ * @param names array of @a max_clients * @a name_size characters.  The
+ * null-terminated name of entry @a i is stored at
+ * <em>names + i * name_size</em>.
+ * @param name_size space for each name, normally jack_client_name_size().
+ * Longer names are truncated.
+ * @param loads array of at least @a max_clients entries to fill in.
+ * @param max_clients number of entries available in @a names and @a loads.
+ *
+ * @return the number of clients, which may exceed @a max_clients
+ * (only the first @a max_clients are stored), or -1 on error.
+ */
+int jack_get_client_loads (jack_client_t *client,
+                           char *names,
+                           size_t name_size,
+                           jack_client_load_t *loads,
+                           unsigned int max_clients) JACK_WEAK_EXPORT;
+
+/**
+ * Reset the @a max_usecs value of every client as reported to
+ * @a client by jack_get_client_load() and jack_get_client_loads().
+ * The maxima are kept separately for each requesting client, so this
+ * does not affect what other clients see, nor the maximum delay
+ * counter reset by jack_reset_max_delayed_usecs().
+ */
+void jack_reset_client_load_max (jack_client_t *client) JACK_WEAK_EXPORT;
+
+/**
+ * Timing of a single completed process cycle, as returned by
+ * jack_get_cycle_history().  The first four members have the same
+ * meaning as the values returned by jack_get_cycle_times().
+ */
+typedef struct {
+    /** frame time counter at the start of the cycle */
+    jack_nframes_t frames;
+    /** microseconds time at the start of the cycle */
+    jack_time_t current_usecs;
+    /** microseconds time of the start of the next cycle, as computed by the DLL */
+    jack_time_t next_usecs;
+    /** estimate of the period time in microseconds */
+    float period_usecs;
+    /** delay between the expected and the actual wakeup of the server, in usecs */
+    float wakeup_delay_usecs;
+    /** time taken to run the whole graph during the cycle, in usecs */
+    float process_usecs;
+} jack_cycle_timing_t;
+
+/**
+ * Retrieve the timing of the most recent process cycles.  The server
+ * keeps a fixed number of past cycles in a lock-free ring, so this
+ * function can be called as often as needed from a non-realtime
+ * thread without disturbing the process cycle.  It should not be
+ * called from the process callback.
+ *
+ * @param client the client making the request
+ * @param cycles array of at least @a max_cycles entries to fill in,
+ * most recent cycle first.
+ * @param max_cycles number of entries available in @a cycles.
+ *
+ * @return the number of entries stored in @a cycles, which may be less
+ * than @a max_cycles if fewer cycles are recorded, or -1 on error.
+ */
+int jack_get_cycle_history (jack_client_t *client,
+                            jack_cycle_timing_t *cycles,
+                            unsigned int max_cycles) JACK_WEAK_EXPORT;
+
 #ifdef __cplusplus
 }
 #endif
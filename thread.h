@@ -73,6 +73,45 @@ int jack_client_max_real_time_priority (jack_client_t*) JACK_OPTIONAL_WEAK_EXPOR
  */
 int jack_acquire_real_time_scheduling (jack_native_thread_t thread, int priority) JACK_OPTIONAL_WEAK_EXPORT;
 
+/**
+ * Attempt to run a thread under deadline scheduling (SCHED_DEADLINE
+ * on Linux) instead of a fixed realtime priority.  The scheduling
+ * period is the duration of one JACK process cycle, derived from
+ * jack_get_buffer_size() and jack_get_sample_rate(), and the thread is
+ * guaranteed @a utilization times that period of CPU time in each
+ * period.  JACK updates these parameters itself whenever the buffer
+ * size or sample rate changes, before calling any @a bufsize_callback.
+ *
+ * Typically @a thread is the client's process thread, as returned by
+ * jack_client_thread_id().  Use jack_drop_real_time_scheduling() to
+ * return the thread to normal scheduling.
+ *
+ * Linux refuses deadline scheduling for a thread whose CPU affinity
+ * does not include every core of its scheduling domain.  This is the
+ * case after jack_set_thread_cpu_affinity() or
+ * jack_client_set_thread_cpu_affinity() pinned the thread to a subset
+ * of the cores.  To combine the two, the pinned cores must form their
+ * own scheduling domain, for example an exclusive cpuset partition.
+ * JACK reports this conflict as EXDEV rather than the EPERM the
+ * kernel uses, so that it can be told apart from missing privileges
+ * and from invalid arguments.
+ *
+ * @param client the JACK client.
+ * @param thread POSIX thread ID.
+ * @param utilization fraction of each process cycle reserved for the
+ * thread, greater than 0 and at most 1.
+ *
+ * @returns 0, if successful; EPERM, if the calling process lacks
+ * required realtime privileges; EINVAL, if @a utilization is not
+ * greater than 0 and at most 1; EXDEV, if the CPU affinity of
+ * @a thread is narrower than its scheduling domain; EBUSY, if the
+ * system cannot admit the requested utilization; ENOSYS, if deadline
+ * scheduling is not available; otherwise some other error number.
+ */
+int jack_client_acquire_deadline_scheduling (jack_client_t *client,
+					     jack_native_thread_t thread,
+					     float utilization) JACK_WEAK_EXPORT;
+
 /**
  * Create a thread for JACK or one of its clients.  The thread is
  * created executing @a start_routine with @a arg as its sole
@@ -105,6 +144,176 @@ int jack_client_create_thread (jack_client_t* client,
  */
 int jack_drop_real_time_scheduling (jack_native_thread_t thread) JACK_OPTIONAL_WEAK_EXPORT;
 
+/**
+ * Restrict a thread to run only on the given CPU cores.
+ *
+ * @param thread POSIX thread ID.
+ * @param cpus array of @a ncpus CPU core numbers, starting from 0.
+ * @param ncpus number of entries in @a cpus.  If zero, the thread
+ * may run on any core again.
+ *
+ * @returns 0, if successful; ENOSYS, if the system does not support
+ * CPU affinity; otherwise some other error number.
+ */
+int jack_set_thread_cpu_affinity (jack_native_thread_t thread,
+				  const int *cpus,
+				  unsigned int ncpus) JACK_WEAK_EXPORT;
+
+/**
+ * Set the CPU cores that the threads JACK runs for @a client may use.
+ * This is applied at once to the client's process thread, and to
+ * every thread created for the client afterwards, including those
+ * created by jack_client_create_thread().  The non-realtime worker
+ * threads of a work queue (see jack_work_queue_create()) are exempt,
+ * so that disk and loading work stays off the cores reserved here.
+ *
+ * On Linux this cannot narrow the affinity of a thread running under
+ * jack_client_acquire_deadline_scheduling(), unless the cores form
+ * their own scheduling domain; see that function for details.
+ *
+ * @param client the JACK client.
+ * @param cpus array of @a ncpus CPU core numbers, starting from 0.
+ * @param ncpus number of entries in @a cpus.  If zero, threads may run
+ * on any core.
+ *
+ * @returns 0, if successful; EXDEV, if a thread of the client is
+ * under deadline scheduling and the cores do not cover its scheduling
+ * domain; otherwise some error number.
+ */
+int jack_client_set_thread_cpu_affinity (jack_client_t *client,
+					 const int *cpus,
+					 unsigned int ncpus) JACK_WEAK_EXPORT;
+
+/**
+ * Retrieve the CPU cores that the system has isolated from general
+ * scheduling (for example with the Linux isolcpus boot parameter).
+ * These are good candidates for jack_set_thread_cpu_affinity().
+ *
+ * @param cpus array of at least @a max_cpus entries to fill in.
+ * @param max_cpus number of entries available in @a cpus.
+ *
+ * @returns the number of isolated cores, which may exceed @a max_cpus
+ * (only the first @a max_cpus are stored), or -1 on error.
+ */
+int jack_get_isolated_cpus (int *cpus, unsigned int max_cpus) JACK_WEAK_EXPORT;
+
+/**
+ *  @ref jack_thread_options_t bits
+ */
+enum JackThreadOptions {
+
+     /**
+      * Null value to use when no option bits are needed.
+      */
+     JackThreadNoOption = 0x00,
+
+     /**
+      * Treat denormal floating point numbers as zero, both as inputs
+      * and as results (DAZ and FTZ on x86, FZ on ARM).  This avoids
+      * the large slowdown some CPUs suffer when processing denormals,
+      * for example in decaying reverb tails.
+      */
+     JackThreadFlushDenormals = 0x01
+};
+
+/**
+ *  Options for threads JACK runs for a client, formed by OR-ing
+ *  together the relevant @ref JackThreadOptions bits.
+ */
+typedef enum JackThreadOptions jack_thread_options_t;
+
+/**
+ * Set the floating point options of the threads JACK runs for
+ * @a client.  They are applied to the client's process thread before
+ * its next callback, and to every thread created for the client
+ * afterwards, including those created by jack_client_create_thread(),
+ * but not the non-realtime worker threads of a work queue (see
+ * jack_work_queue_create()).  This saves clients from setting them in
+ * a JackThreadInitCallback.
+ *
+ * @param client the JACK client.
+ * @param options formed by OR-ing together @ref JackThreadOptions bits.
+ *
+ * @returns 0, if successful; ENOSYS, if an option is not supported on
+ * this CPU; otherwise some other error number.
+ */
+int jack_client_set_thread_options (jack_client_t *client,
+				    jack_thread_options_t options) JACK_WEAK_EXPORT;
+
+/**
+ * @returns the @ref JackThreadOptions bits that are currently in
+ * effect for the calling thread, as read from the floating point
+ * control registers.  This is useful for diagnostics, and is suitable
+ * for real-time execution.
+ */
+jack_thread_options_t jack_get_thread_options (void) JACK_WEAK_EXPORT;
+
+/**
+ *  jack_thread_pool_t is an opaque type representing a set of realtime
+ *  worker threads owned by a client.  You may only access it using the
+ *  API provided.
+ */
+typedef struct _jack_thread_pool jack_thread_pool_t;
+
+/**
+ * Prototype for the client supplied function run by
+ * jack_thread_pool_parallel_for().
+ *
+ * @param index index of the work item, from 0 to count - 1.
+ * @param arg pointer supplied to jack_thread_pool_parallel_for().
+ */
+typedef void (*JackParallelForCallback)(unsigned int index, void *arg);
+
+/**
+ * Create a pool of @a nthreads realtime worker threads for @a client,
+ * so that a client can spread the work of a single process cycle over
+ * several CPU cores.  The threads are created with
+ * jack_client_create_thread() at the client's realtime priority, and
+ * sleep until work is submitted with jack_thread_pool_parallel_for().
+ * They use the affinity set by jack_client_set_thread_cpu_affinity()
+ * and the options set by jack_client_set_thread_options().
+ *
+ * This function is not suitable for real-time execution.
+ *
+ * @param client the JACK client owning the pool.
+ * @param nthreads number of worker threads.  If zero, JACK picks one
+ * less than the number of available CPU cores.
+ *
+ * @returns the new pool, or NULL on error.
+ */
+jack_thread_pool_t *jack_thread_pool_create (jack_client_t *client,
+					     unsigned int nthreads) JACK_WEAK_EXPORT;
+
+/**
+ * Stop the worker threads of @a pool and release it.  Must not be
+ * called while jack_thread_pool_parallel_for() is running on it.
+ */
+void jack_thread_pool_destroy (jack_thread_pool_t *pool) JACK_WEAK_EXPORT;
+
+/**
+ * @returns the number of worker threads in @a pool.
+ */
+unsigned int jack_thread_pool_size (jack_thread_pool_t *pool) JACK_WEAK_EXPORT;
+
+/**
+ * Call @a callback once for each index from 0 to @a count - 1,
+ * distributing the calls over the worker threads of @a pool and the
+ * calling thread.  Returns only when every call has completed, so
+ * calling it from the process callback (or before jack_cycle_signal())
+ * guarantees the work is finished within the current cycle.
+ *
+ * Calls may run concurrently and in any order.  @a callback must be
+ * suitable for real-time execution.
+ *
+ * This function is suitable for real-time execution.
+ *
+ * @returns 0, if successful; otherwise some error number.
+ */
+int jack_thread_pool_parallel_for (jack_thread_pool_t *pool,
+				   unsigned int count,
+				   JackParallelForCallback callback,
+				   void *arg) JACK_WEAK_EXPORT;
+
 typedef int (*jack_thread_creator_t)(jack_native_thread_t*,
 				     const pthread_attr_t*,
 				     void* (*function)(void*),
@@ -65,6 +65,24 @@ typedef uint32_t	     jack_nframes_t;
  */
 typedef uint64_t jack_time_t;
 
+/**
+ * A consistent copy of the timing state JACK uses to map between
+ * frame times and microseconds, as returned by
+ * jack_get_clock_snapshot().  Apart from @a period_frames, the members
+ * have the same meaning as the values returned by jack_get_cycle_times().
+ */
+typedef struct {
+    /** frame time counter at the start of the cycle */
+    jack_nframes_t frames;
+    /** buffer size of the cycle, i.e. the number of frames between
+        @a current_usecs and @a next_usecs, used by the conversions */
+    jack_nframes_t period_frames;
+    /** microseconds time at the start of the cycle */
+    jack_time_t current_usecs;
+    /** microseconds time of the start of the next cycle */
+    jack_time_t next_usecs;
+} jack_clock_snapshot_t;
+
 /**
  *  Maximum size of @a load_init string passed to an internal client
  *  jack_initialize() function via jack_internal_client_load().
@@ -96,6 +114,13 @@ typedef struct _jack_client  jack_client_t;
  */
 typedef uint32_t	     jack_port_id_t;
 
+/**
+ *  jack_port_pattern_t is an opaque type holding a port selection
+ *  compiled by jack_port_pattern_compile().  You may only access it
+ *  using the API provided.
+ */
+typedef struct _jack_port_pattern jack_port_pattern_t;
+
 /**
  *  @ref jack_options_t bits
  */
@@ -461,6 +486,27 @@ typedef void (*JackInfoShutdownCallback)(jack_status_t code, const char* reason,
 #define JACK_DEFAULT_AUDIO_TYPE "32 bit float mono audio"
 #define JACK_DEFAULT_MIDI_TYPE "8 bit raw midi"
 
+/**
+ * Used for the type argument of jack_port_register() for built-in
+ * double precision audio ports.  Buffers of this type hold
+ * jack_double_audio_sample_t values, and can only be connected to
+ * other ports of the same type.
+ */
+#define JACK_DOUBLE_AUDIO_TYPE "64 bit float mono audio"
+
+/**
+ * Port type of built-in multichannel audio ports, as created by
+ * jack_port_register_multichannel().  The buffer of such a port holds
+ * one block of nframes jack_default_audio_sample_t values per channel.
+ * Each block is padded to a multiple of the buffer alignment, so
+ * channel @a c of a buffer @a buf starts at <em>buf + c * stride</em>,
+ * where <em>stride</em> is given by jack_port_channel_stride(), and
+ * every channel is aligned on its own as described for
+ * jack_port_get_buffer().  Ports of this type can only be connected
+ * to other ports of the same type with the same number of channels.
+ */
+#define JACK_MULTICHANNEL_AUDIO_TYPE "32 bit float planar audio"
+
 /**
  * For convenience, use this typedef if you want to be able to change
  * between float and double. You may want to typedef sample_t to
@@ -468,6 +514,11 @@ typedef void (*JackInfoShutdownCallback)(jack_status_t code, const char* reason,
  */
 typedef float jack_default_audio_sample_t;
 
+/**
+ * Sample type of ports registered with @ref JACK_DOUBLE_AUDIO_TYPE.
+ */
+typedef double jack_double_audio_sample_t;
+
 /**
  *  A port has a set of flags that are formed by OR-ing together the
  *  desired values from the list below. The flags "JackPortIsInput" and
@@ -0,0 +1,165 @@
+/*
+    Copyright (C) 2026 JACK developers
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+*/
+
+#ifndef __jack_workqueue_h__
+#define __jack_workqueue_h__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <jack/weakmacros.h>
+#include <jack/types.h>
+#include <stdlib.h>
+
+/** @file workqueue.h
+ *
+ * Library functions to move non-realtime work, such as disk I/O or
+ * sample loading, out of a client's process callback.  The process
+ * callback submits requests to a queue, which are run by background
+ * worker threads.  A worker may send responses back, which are
+ * delivered in the process thread at the start of a later cycle.
+ *
+ * Requests and responses are small messages that are copied into the
+ * queue, so the process callback never waits for a worker and never
+ * shares memory with it unless the client chooses to.
+ */
+
+/**
+ * @defgroup WorkQueue Deferring work to non-realtime threads
+ * @{
+ */
+
+/**
+ *  jack_work_queue_t is an opaque type.  You may only access it using
+ *  the API provided.
+ */
+typedef struct _jack_work_queue jack_work_queue_t;
+
+/**
+ * Prototype for the client supplied function that handles a request
+ * submitted with jack_work_queue_submit().  It is called in a worker
+ * thread, does not need to be suitable for real-time execution, and
+ * may call jack_work_queue_respond() any number of times.
+ *
+ * @param queue the queue the request was submitted to.
+ * @param data a copy of the request data.
+ * @param size size of @a data in bytes.
+ * @param arg pointer supplied to jack_work_queue_create().
+ */
+typedef void (*JackWorkCallback)(jack_work_queue_t *queue,
+                                 const void *data, size_t size, void *arg);
+
+/**
+ * Prototype for the client supplied function that receives a response
+ * sent with jack_work_queue_respond().  It is called in the client's
+ * process thread, just before its process callback, and must be
+ * suitable for real-time execution.
+ *
+ * @param data a copy of the response data.
+ * @param size size of @a data in bytes.
+ * @param arg pointer supplied to jack_work_queue_create().
+ */
+typedef void (*JackWorkResponseCallback)(const void *data, size_t size, void *arg);
+
+/**
+ * Create a work queue for @a client, served by @a nthreads worker
+ * threads.  The queue is destroyed, as if by jack_work_queue_destroy(),
+ * when the client is closed.  It must not be used or destroyed after
+ * jack_client_close() has been called.
+ *
+ * The worker threads use normal, non-realtime scheduling.  They are
+ * not subject to jack_client_set_thread_cpu_affinity() or
+ * jack_client_set_thread_options(), and run on any core with the
+ * default floating point settings.  A @ref JackWorkCallback that needs
+ * otherwise may call jack_set_thread_cpu_affinity() on its own thread.
+ *
+ * This function is not suitable for real-time execution.
+ *
+ * @param client the JACK client owning the queue.
+ * @param nthreads number of non-realtime worker threads, at least 1.
+ * @param queue_size size in bytes of the request and of the response
+ * queues.
+ * @param work_callback function run in a worker thread for each request.
+ * @param response_callback function run in the process thread for each
+ * response, may be NULL if no responses are sent.
+ * @param arg argument for @a work_callback and @a response_callback.
+ *
+ * @return a pointer to a new jack_work_queue_t, if successful; NULL
+ * otherwise.
+ */
+jack_work_queue_t *jack_work_queue_create (jack_client_t *client,
+                                           unsigned int nthreads,
+                                           size_t queue_size,
+                                           JackWorkCallback work_callback,
+                                           JackWorkResponseCallback response_callback,
+                                           void *arg) JACK_WEAK_EXPORT;
+
+/**
+ * Wait for the worker threads of @a queue to finish their current
+ * requests, discard any pending requests and responses, and free
+ * the queue.
+ *
+ * Must not be called while any thread may still call
+ * jack_work_queue_submit() on @a queue, nor while the client is
+ * active, since responses are delivered in its process thread.  Call
+ * it before jack_activate() or after jack_deactivate().
+ *
+ * This function is not suitable for real-time execution.
+ */
+void jack_work_queue_destroy (jack_work_queue_t *queue) JACK_WEAK_EXPORT;
+
+/**
+ * Copy a request of @a size bytes from @a data into @a queue, to be
+ * handled by a worker thread.
+ *
+ * This function is suitable for real-time execution.  It is normally
+ * called from the process callback, but may be called from any thread,
+ * and several threads (for example the process thread and the workers
+ * of a jack_thread_pool_t) may submit to the same queue concurrently.
+ *
+ * @return 0 on success, ENOBUFS if there is not enough space in the
+ * request queue.
+ */
+int jack_work_queue_submit (jack_work_queue_t *queue,
+                            const void *data,
+                            size_t size) JACK_WEAK_EXPORT;
+
+/**
+ * Copy a response of @a size bytes from @a data into @a queue, to be
+ * delivered to the response callback in the process thread at the
+ * start of the next process cycle.
+ *
+ * This function may only be called from a @ref JackWorkCallback.
+ * Several worker threads of the same queue may respond concurrently.
+ *
+ * @return 0 on success, ENOBUFS if there is not enough space in the
+ * response queue.
+ */
+int jack_work_queue_respond (jack_work_queue_t *queue,
+                             const void *data,
+                             size_t size) JACK_WEAK_EXPORT;
+
+/*@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __jack_workqueue_h__ */